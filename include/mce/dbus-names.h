@@ -124,6 +124,30 @@
  */
 # define MCE_RADIO_STATES_CHANGE_REQ       "req_radio_states_change"
 
+/** Request conditional radio states change
+ *
+ * @since mce 1.114.0
+ *
+ * Like #MCE_RADIO_STATES_CHANGE_REQ, but the change is applied
+ * only if the current radio states bitmask equals the expected
+ * value, i.e.
+ *
+ * if (current == expected)
+ *     current = (current & ~mask) | (value & mask)
+ *
+ * Allows clients to make read-modify-write changes without
+ * racing against other clients changing the radio states.
+ *
+ * @param expected uint32: bitmask the client assumes to be current
+ * @param value    uint32: bitmask of values to use
+ * @param mask     uint32: bitmask of values to change
+ *
+ * @return boolean: TRUE if the change was applied, or
+ *                  FALSE if the current state did not match
+ * @return uint32: bitmask of currently enabled radios
+ */
+# define MCE_RADIO_STATES_COMPARE_CHANGE_REQ "req_radio_states_compare_change"
+
 /** Notify everyone that the radio states have changed
  *
  * @since mce 1.10.60
@@ -393,9 +417,71 @@
 /** Cancel display blanking prevention
  *
  * @since mce 1.10.35
+ *
+ * @note Since mce 1.114.0 also leases obtained via
+ *       #MCE_PREVENT_BLANK_LEASE_REQ are cancelled.
  */
 # define MCE_CANCEL_PREVENT_BLANK_REQ      "req_display_cancel_blanking_pause"
 
+/** Prevent display from blanking for a given duration
+ *
+ * @since mce 1.114.0
+ *
+ * Works like #MCE_PREVENT_BLANK_REQ, except that the client
+ * specifies how long the blanking pause should last and does
+ * not need to re-issue the call every 60 seconds.
+ *
+ * To limit the battery impact of clients that fail to cancel
+ * their leases, durations longer than one hour (3600000 ms) are
+ * clamped to one hour. The granted duration is returned in the
+ * reply and clients wanting to keep the display on for longer
+ * need to make a new request before the lease expires.
+ *
+ * Zero or negative duration is rejected with an error reply.
+ *
+ * The same conditions as with #MCE_PREVENT_BLANK_REQ apply,
+ * i.e. the request is ignored when #MCE_PREVENT_BLANK_ALLOWED_GET
+ * would return false. If blanking pause becomes disallowed while
+ * a lease is active - for example due to lockscreen activation or
+ * display getting turned off - the lease is terminated and will
+ * not be resumed when blanking pause becomes allowed again.
+ * Clients can track #MCE_PREVENT_BLANK_ALLOWED_SIG to notice this.
+ *
+ * Active leases are reflected in #MCE_PREVENT_BLANK_GET replies and
+ * #MCE_PREVENT_BLANK_SIG signals just like blanking pauses started
+ * with #MCE_PREVENT_BLANK_REQ.
+ *
+ * When application no longer wishes to keep display from blanking,
+ * it should make a #MCE_CANCEL_PREVENT_BLANK_LEASE_REQ method call
+ * using the handle returned by this call. Making a
+ * #MCE_CANCEL_PREVENT_BLANK_REQ method call cancels all leases
+ * held by the client.
+ *
+ * @note If client drops from the system bus, it is handled as if
+ *       the client would have cancelled all of its leases.
+ *
+ * @param duration int32: requested blanking pause length [ms]
+ *
+ * @return uint32: lease handle, or 0 if the request was ignored
+ * @return int32: granted blanking pause length [ms], or 0 if the
+ *                request was ignored
+ */
+# define MCE_PREVENT_BLANK_LEASE_REQ       "req_display_blanking_pause_lease"
+
+/** Cancel display blanking prevention lease
+ *
+ * @since mce 1.114.0
+ *
+ * Ends a blanking pause started with #MCE_PREVENT_BLANK_LEASE_REQ.
+ *
+ * Lease handles are valid only for the D-Bus connection that
+ * obtained them. Cancel requests made by other senders, as well
+ * as unknown and already expired handles, are ignored.
+ *
+ * @param handle uint32: lease handle
+ */
+# define MCE_CANCEL_PREVENT_BLANK_LEASE_REQ "req_display_cancel_blanking_pause_lease"
+
 /** Get current blank prevention status
  *
  * @since mce 1.51.0
@@ -658,6 +744,10 @@
  * @note The boolean reply message is optional and will be sent
  *       only if requested.
  *
+ * @since mce 1.23.7
+ *
+ * Optional tracking id, see #MCE_CPU_KEEPALIVE_PERIOD_REQ.
+ *
  * @param context string: "unique enough" tracking id
  *
  * @return boolean: TRUE on success, or FALSE in case of errors
@@ -675,12 +765,45 @@
  * @note The boolean reply message is optional and will be sent
  *       only if requested.
  *
+ * @since mce 1.23.7
+ *
+ * Optional tracking id, see #MCE_CPU_KEEPALIVE_PERIOD_REQ.
+ *
  * @param context string: "unique enough" tracking id
  *
  * @return boolean: TRUE on success, or FALSE in case of errors
  */
 # define MCE_CPU_KEEPALIVE_STOP_REQ        "req_cpu_keepalive_stop"
 
+/** Block late suspend for as long as the returned file descriptor is open
+ *
+ * @since mce 1.114.0
+ *
+ * Alternative to the #MCE_CPU_KEEPALIVE_START_REQ protocol that
+ * does not require periodic renew calls.
+ *
+ * The reply contains a file descriptor passed via D-Bus unix fd
+ * passing. MCE blocks late suspend until the client closes the
+ * file descriptor. As the kernel closes all file descriptors of
+ * exiting processes, the block is released also if the client
+ * exits or crashes.
+ *
+ * The file descriptor is not meant to be read from or written to.
+ *
+ * @note Requires D-Bus connection that supports unix fd passing.
+ *
+ * @note Leases do not survive mce restarts. The file descriptor
+ *       remains open on the client side, but no longer blocks late
+ *       suspend. Clients should request a new lease when they notice
+ *       that mce has been restarted, i.e. after a change in
+ *       #MCE_SERVICE name ownership.
+ *
+ * @param context string: "unique enough" tracking id
+ *
+ * @return unix_fd: keepalive lease file descriptor
+ */
+# define MCE_CPU_KEEPALIVE_LEASE_REQ       "req_cpu_keepalive_lease"
+
 /** Signal wakeup from suspend due to aligned timer triggering
  *
  * @since mce 1.12.8
@@ -734,6 +857,35 @@
  */
 # define MCE_CONFIG_GET_ALL                "get_config_all"
 
+/** Query configuration values changed since given generation
+ *
+ * @since mce 1.114.0
+ *
+ * MCE maintains a configuration generation counter that is
+ * incremented every time any runtime setting value changes.
+ *
+ * Returns the current generation and array of (key,value) pairs
+ * for settings that have been changed after the given generation,
+ * in the same format as what #MCE_CONFIG_GET_ALL uses.
+ *
+ * If the changes can't be determined - the given generation is zero,
+ * larger than the current generation, or too old to be tracked - all
+ * settings are returned, as if #MCE_CONFIG_GET_ALL had been called.
+ *
+ * @note Generation values are meaningful only within the lifetime
+ *       of one mce process. Clients should use zero generation when
+ *       they notice that mce has been restarted, i.e. after a change
+ *       in #MCE_SERVICE name ownership.
+ *
+ * @param generation uint64: generation seen by the client, or zero
+ *
+ * @return uint64: current generation
+ * @return boolean: TRUE if all settings are included, or
+ *                  FALSE if only changed settings are included
+ * @return array of dict entries from setting key names and value variants
+ */
+# define MCE_CONFIG_GET_CHANGED            "get_config_changed"
+
 /** Set configuration value
  *
  * @since mce 1.12.15
@@ -745,6 +897,27 @@
  */
 # define MCE_CONFIG_SET                    "set_config"
 
+/** Set multiple configuration values
+ *
+ * @since mce 1.114.0
+ *
+ * Takes array of (key,value) pairs in the same format as what
+ * #MCE_CONFIG_GET_ALL returns.
+ *
+ * The values are validated before making any changes; if any of
+ * the keys is unknown or any of the values has unexpected type,
+ * an error reply is sent and no settings are changed.
+ *
+ * Once the settings have been changed, one #MCE_CONFIG_CHANGE_ALL_SIG
+ * signal listing all changed settings is emitted.
+ *
+ * @param values array of dict entries from setting key names and
+ *               value variants
+ *
+ * @return boolean: success, or error reply in case of failure
+ */
+# define MCE_CONFIG_SET_ALL                "set_config_all"
+
 /** Reset configuration values to default
  *
  * All config settings with keyname that matches the given substring
@@ -768,6 +941,35 @@
  */
 # define MCE_CONFIG_CHANGE_SIG             "config_change_ind"
 
+/** Notify everyone that one or more mce configuration values have changed
+ *
+ * @since mce 1.114.0
+ *
+ * Emitted once for every operation that changes at least one
+ * setting value, listing all the settings that were changed.
+ * This covers #MCE_CONFIG_SET, #MCE_CONFIG_SET_ALL and
+ * #MCE_CONFIG_RESET requests as well as changes made by
+ * mce itself.
+ *
+ * #MCE_CONFIG_CHANGE_SIG is still emitted for each changed setting
+ * for the sake of backwards compatibility. Clients should track
+ * only one of the two signals, using narrow match rules, as
+ * matching the whole signal interface delivers both:
+ *
+ * - Clients that want to follow all settings, e.g. settings ui,
+ *   can track this signal and get one wakeup per operation.
+ *
+ * - Clients that are interested only in specific settings should
+ *   keep tracking #MCE_CONFIG_CHANGE_SIG, using
+ *   #MCE_CONFIG_CHANGE_MATCH_KEY or #MCE_CONFIG_CHANGE_MATCH_PREFIX
+ *   match rules. This signal can't be filtered by setting key name
+ *   and would wake them up for every change.
+ *
+ * @param values array of dict entries from changed setting key names
+ *               and value variants
+ */
+# define MCE_CONFIG_CHANGE_ALL_SIG         "config_change_all_ind"
+
 /*@}*/
 
 /////////////////////////////////////////////////////////////////////////////
@@ -885,7 +1087,7 @@
  *
  * @since mce 1.86.0
  *
- * @param bettery_level int32: battery level percent, or #MCE_BATTERY_LEVEL_UNKNOWN
+ * @param battery_level int32: battery level percent, or #MCE_BATTERY_LEVEL_UNKNOWN
  */
 # define MCE_BATTERY_LEVEL_SIG             "battery_level_ind"
 
@@ -1623,6 +1825,51 @@
  */
 # define MCE_VERSION_GET                   "get_version"
 
+/** Query current values of commonly tracked states in one go
+ *
+ * @since mce 1.114.0
+ *
+ * Used for: Client startup, so that initial values for states that
+ * are going to be tracked via signals can be obtained with a single
+ * round trip instead of making separate queries for each.
+ *
+ * The data returned is - in dbus terms - array of dictionary entries
+ * having query method name as a key and the value that the query would
+ * return as value.
+ *
+ *     array [
+ *        dict entry(
+ *           string QUERY_METHOD_NAME
+ *           variant QUERY_METHOD_RETURN_VALUE
+ *        )
+ *        ...
+ *     ]
+ *
+ * The following entries are included:
+ * - #MCE_RADIO_STATES_GET
+ * - #MCE_CALL_STATE_GET (struct of call state and call type strings)
+ * - #MCE_DISPLAY_STATUS_GET
+ * - #MCE_TKLOCK_MODE_GET
+ * - #MCE_PSM_STATE_GET
+ * - #MCE_INACTIVITY_STATUS_GET
+ * - #MCE_USB_CABLE_STATE_GET
+ * - #MCE_CHARGER_STATE_GET
+ * - #MCE_BATTERY_STATUS_GET
+ * - #MCE_BATTERY_STATE_GET
+ * - #MCE_BATTERY_LEVEL_GET
+ * - #MCE_MEMORY_LEVEL_GET
+ * - #MCE_TOUCH_INPUT_POLICY_GET
+ * - #MCE_VOLKEY_INPUT_POLICY_GET
+ * - #MCE_HARDWARE_KEYBOARD_STATE_GET
+ * - #MCE_HARDWARE_MOUSE_STATE_GET
+ *
+ * Clients should ignore entries they do not recognize, and be
+ * prepared to fall back to individual queries for missing entries.
+ *
+ * @return array of dict entries from query method names and value variants
+ */
+# define MCE_STATE_SNAPSHOT_GET            "get_state_snapshot"
+
 /** Request powerkey event triggering
  *
  * @since mce 1.5.3 (implemented)
@@ -1665,7 +1912,7 @@
  *        ...
  *     ]
  *
- * @return array of entries as described above
+ * @return array of dict entries with struct {int64, int64} values
  */
 # define MCE_DISPLAY_STATS_GET             "get_display_stats"
 
@@ -1708,4 +1955,69 @@
 
 /*@}*/
 
+/////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////
+/** @name Signal Match Rules
+ *
+ * Helpers for constructing D-Bus match rules that select only
+ * the mce signals the client is actually interested in.
+ *
+ * Matching on interface only, e.g. "interface='com.nokia.mce.signal'",
+ * makes the client wake up for every signal mce emits - including
+ * high rate ones like #MCE_FADER_OPACITY_SIG and #MCE_CONFIG_CHANGE_SIG.
+ * Using one narrow rule per tracked signal avoids that.
+ *
+ * All of the macros expand to string literals and can thus be used
+ * for example as:
+ *
+ *     dbus_bus_add_match(con, MCE_SIGNAL_MATCH(MCE_DISPLAY_SIG), 0);
+ *
+ *@{
+ */
+
+/** Match rule for an mce signal
+ *
+ * @since mce-dev 1.33.0
+ *
+ * @param member string literal: signal name, e.g. #MCE_DISPLAY_SIG
+ */
+# define MCE_SIGNAL_MATCH(member)\
+     "type='signal'"\
+     ",sender='" MCE_SERVICE "'"\
+     ",interface='" MCE_SIGNAL_IF "'"\
+     ",path='" MCE_SIGNAL_PATH "'"\
+     ",member='" member "'"
+
+/** Match rule for change signals of one mce setting
+ *
+ * @since mce-dev 1.33.0
+ *
+ * Matches #MCE_CONFIG_CHANGE_SIG signals where the setting key
+ * name equals the given key.
+ *
+ * @param key string literal: setting key name
+ */
+# define MCE_CONFIG_CHANGE_MATCH_KEY(key)\
+     MCE_SIGNAL_MATCH(MCE_CONFIG_CHANGE_SIG)\
+     ",arg0='" key "'"
+
+/** Match rule for change signals of a group of mce settings
+ *
+ * @since mce-dev 1.33.0
+ *
+ * Matches #MCE_CONFIG_CHANGE_SIG signals where the setting key
+ * name starts with the given path prefix, e.g. using prefix
+ * "/system/osso/dsm/display/" selects only display related settings.
+ *
+ * @note Uses arg0path matching, which requires that the prefix
+ *       ends with a slash character.
+ *
+ * @param prefix string literal: initial part of setting key name
+ */
+# define MCE_CONFIG_CHANGE_MATCH_PREFIX(prefix)\
+     MCE_SIGNAL_MATCH(MCE_CONFIG_CHANGE_SIG)\
+     ",arg0path='" prefix "'"
+
+/*@}*/
+
 #endif /* MCE_DBUS_NAMES_H_ */
@@ -1,6 +1,6 @@
 Name:       mce-headers
 Summary:    Development files for mce
-Version:    1.32.1
+Version:    1.33.0
 Release:    1
 License:    LGPLv2
 URL:        https://github.com/sailfishos/mce-dev
@@ -29,7 +29,7 @@ provided by the Mode Control Entity, and the signals emitted by it.
 make doc
 
 %install
-make install PCDIR=%{_libdir}/pkgconfig DESTDIR=%{?buildroot}
+make install PCDIR=%{_libdir}/pkgconfig DATADIR=%{_datadir} DESTDIR=%{?buildroot}
 install -d %{buildroot}/%{_docdir}/mce-doc/html/
 install -m 644 doc/html/* %{buildroot}/%{_docdir}/mce-doc/html/
 
@@ -37,6 +37,9 @@ install -m 644 doc/html/* %{buildroot}/%{_docdir}/mce-doc/html/
 %doc COPYING debian/copyright
 %{_includedir}/mce/*.h
 %{_libdir}/pkgconfig/mce.pc
+%{_datadir}/dbus-1/interfaces/com.nokia.mce.request.xml
+%{_datadir}/dbus-1/interfaces/com.nokia.mce.signal.xml
+%{_datadir}/mce-dev/mce-api.json
 
 %files -n mce-doc
 %doc COPYING debian/changelog debian/copyright